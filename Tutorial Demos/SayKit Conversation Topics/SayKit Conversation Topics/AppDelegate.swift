@@ -63,6 +63,9 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
 
     func applicationWillEnterForeground(application: UIApplication) {
         // Called as part of the transition from the background to the inactive state; here you can undo many of the changes made on entering the background.
+        
+        // Refresh the API keys in the background so the first request after idle doesn't wait on them
+        SAYAPIKeyManager.sharedInstance().prefetchAPIKeys()
     }
 
     func applicationDidBecomeActive(application: UIApplication) {